@@ -0,0 +1,76 @@
+# include "FormatSelector.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+// 2D Laplacian on a n x n grid (5 diagonals)
+CRSmatrix<double> laplace2d(std::size_t n)
+{
+   std::vector<std::size_t> ia(1,0), ja;
+   std::vector<double> aa;
+   for(std::size_t i=0 ; i < n*n ; i++)
+   {
+      if(i >= n)          { ja.push_back(i-n); aa.push_back(-1.); }
+      if(i % n != 0)      { ja.push_back(i-1); aa.push_back(-1.); }
+                            ja.push_back(i);   aa.push_back( 4.); 
+      if(i % n != n-1)    { ja.push_back(i+1); aa.push_back(-1.); }
+      if(i + n < n*n)     { ja.push_back(i+n); aa.push_back(-1.); }
+      ia.push_back(ja.size());
+   }
+   return CRSmatrix<double>(n*n, n*n, ia, ja, aa);
+}
+
+
+int main() {
+
+  CRSmatrix<double> lap = laplace2d(100);
+  
+  profile(lap).print();
+  cout << "----------------------------------------------------------" << endl;   
+  
+  std::vector<double> x(lap.size2());
+  for(std::size_t i=0 ; i < x.size() ; i++) x[i] = 1.0 + i % 7 ;
+  std::vector<double> ref = lap * x ;
+
+  for(auto f : candidateFormats)
+  {
+     if(std::isinf(predictedBytes<double>(profile(lap), f))) continue ; 
+     const auto op = makeOperator(lap, f);
+     const auto y  = (*op) * x ;
+     double err = 0.;
+     for(std::size_t i=0 ; i < y.size() ; i++) err = std::max(err, fabs(y[i]-ref[i]));
+     cout << setw(8) << op->format() << "  predicted bytes : " << setw(10) << predictedBytes<double>(profile(lap), f) 
+          << "   max error : " << err << endl;
+  }
+  cout << "----------------------------------------------------------" << endl;   
+
+  SelectionOptions opt ;
+  opt.trialRuns = 20 ;
+  opt.cacheFile = "format.cache" ;
+  
+  auto op1 = makeSparseOperator(lap, opt);
+  cout << "selected (trial)  : " << op1->format() << endl;
+  auto op2 = makeSparseOperator(lap, opt);
+  cout << "selected (cached) : " << op2->format() << endl;
+  cout << "----------------------------------------------------------" << endl;   
+
+  COOmatrix<double> coo("coo_matrix.mtx");
+  profile(coo).print();
+  auto op3 = makeSparseOperator(coo);
+  cout << "selected : " << op3->format() << endl;
+  cout << "----------------------------------------------------------" << endl;   
+  
+  CRSmatrix<int> crs("input17.dat");
+  profile(crs).print();
+  auto op4 = makeSparseOperator(crs);
+  std::vector<int> v1 =  {3,4,0,1,6,8,1,19};    
+  for(auto& y : (*op4)*v1 )
+     cout << y << ' ' ;
+  cout << "  <-- " << op4->format() << endl;   
+  for(auto& y : crs*v1 )
+     cout << y << ' ' ;
+  cout << "  <-- CRS" << endl;   
+
+  return 0;
+}
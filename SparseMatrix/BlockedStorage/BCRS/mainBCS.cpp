@@ -62,6 +62,28 @@ int main(){
   cout << endl;   
   cout << "-----------------------------------------------------------------------------------" << endl;   
 
+  // rectangular 4x6 , 2x3 blocks : y has size1() entries , x size2()
+  BCRSmatrix<double,2,3> bbcsr9 = {{11,12,13,14,0,0},{0,22,23,0,0,0},{0,0,33,34,35,36},{0,0,0,44,45,0}} ;
+  const std::vector<double> x9 = {1,2,3,4,5,6};
+  const auto y9 = bbcsr9 * x9 ;
+  double e9 = 0 ;
+  for(std::size_t i=1 ; i <= bbcsr9.size1() ; i++)
+  {
+     double r = 0 ;
+     for(std::size_t j=1 ; j <= bbcsr9.size2() ; j++)
+        r += bbcsr9(i,j) * x9[j-1] ;
+     e9 = std::max(e9, std::abs(r - y9[i-1]));
+  }
+  cout << "4x6 (2x3 blocks) : " ;
+  for(auto& x : y9) cout << x << ' ' ;
+  cout << "  size " << y9.size() << "  |y - dense| " << e9 << endl;
+  try {
+     bbcsr9 * std::vector<double>(4, 1.) ;
+  } catch(const InvalidSizeException& e) {
+     cout << "4x6 * 4-vector : " << e.what() << endl;
+  }
+  cout << "-----------------------------------------------------------------------------------" << endl;
+
   BCRSmatrix<double,2,2> bbcsr8("input21.dat");
   cout << "-----------------------------------------------------------------------------------" << endl;   
 
@@ -0,0 +1,120 @@
+# include <chrono>
+# include <type_traits>
+# include "CSRDUmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// 3D 27-point stencil n^3 x n^3 : clustered columns as in FEM matrices ,
+// a handful of distinct coefficients (CSR-VI)
+//
+CRSmatrix<double> stencil27(const std::size_t n)
+{
+    std::vector<std::size_t> ia{0} , ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < n ; i++)
+     for(std::size_t j=0 ; j < n ; j++)
+      for(std::size_t k=0 ; k < n ; k++)
+      {
+         for(int di=-1 ; di <= 1 ; di++)
+          for(int dj=-1 ; dj <= 1 ; dj++)
+           for(int dk=-1 ; dk <= 1 ; dk++)
+           {
+              const long a = long(i)+di , b = long(j)+dj , c = long(k)+dk ;
+              if(a < 0 || b < 0 || c < 0 || a >= long(n) || b >= long(n) || c >= long(n)) continue ;
+              ja.push_back((a*n + b)*n + c);
+              aa.push_back(di==0 && dj==0 && dk==0 ? 26. : -1. - 0.5*std::abs(di+dj+dk));
+           }
+         ia.push_back(ja.size());
+      }
+    return CRSmatrix<double>(n*n*n, n*n*n, std::move(ia), std::move(ja), std::move(aa));
+}
+
+template <typename M>
+double timeSpMV(const M& A, const std::vector<double>& x, std::vector<double>& y, const std::size_t runs)
+{
+    y = A*x ;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t r=0 ; r < runs ; r++)
+       y = A*x ;
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()/runs*1e3 ;
+}
+
+double maxDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double d = 0 ;
+    for(std::size_t i=0 ; i < a.size() ; i++)
+       d = std::max(d, std::abs(a[i]-b[i]));
+    return d ;
+}
+
+
+int main(int argc, char** argv){
+
+  const std::size_t n    = argc > 1 ? std::stoul(argv[1]) : 60 ;
+  const std::size_t runs = argc > 2 ? std::stoul(argv[2]) : 20 ;
+
+  CSRDUmatrix<double> du1("mat003.mtx");
+  du1.print();
+  std::vector<double> x1 = {1.,2.,3.,4.};
+  cout << "CRS  : " ;  for(auto v : du1.crs()*x1) cout << v << ' ' ;
+  cout << endl << "DU   : " ;  for(auto v : du1*x1) cout << v << ' ' ;
+  cout << endl;
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  CRSmatrix<double>   crs2("input17.dat");
+  CSRDUmatrix<double> du2(crs2, true);
+  std::vector<double> x2(crs2.size2(), 1.) ;
+  cout << "input17  units : " << du2.units() << "  distinct values : " << du2.distinctValues()
+       << "  |y_crs - y_vi| : " << maxDiff(crs2*x2, du2*x2) << endl;
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  // no writable CRS base : a write would not reach the encoded stream
+  static_assert(!std::is_convertible<CSRDUmatrix<double>&, CRSmatrix<double>&>::value ,
+                "CSRDUmatrix must not expose its CRS base for writing");
+
+  // 1 , 2 and 4 byte value indices
+  for(std::size_t d : {200ul, 3000ul, 70000ul})
+  {
+     std::vector<std::size_t> ia{0} , ja ;
+     std::vector<double>      aa ;
+     for(std::size_t i=0 ; i < d ; i++)
+     {
+        for(std::size_t j : {i, (i*7919) % d})
+        {
+           if(j == i && ja.size() > ia.back()) continue ;
+           ja.push_back(j); aa.push_back(0.5 + i);
+        }
+        ia.push_back(ja.size());
+     }
+     const CRSmatrix<double>   c(d, d, ia, ja, aa);
+     const CSRDUmatrix<double> v(c, true);
+     const std::vector<double> xd(d, 1.);
+     cout << d << " distinct values  |y_crs - y_vi| : " << maxDiff(c*xd, v*xd) << endl;
+  }
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  const auto A = stencil27(n);
+  const CSRDUmatrix<double> du(A) , vi(A, true) ;
+  const std::vector<double> x(A.size2(), 1.);
+  std::vector<double> y0 , y1 , y2 ;
+
+  const double crsBytes = A.aa().size()*(sizeof(double)+sizeof(std::size_t)) + A.ia().size()*sizeof(std::size_t) ;
+  const double t0 = timeSpMV(A , x, y0, runs);
+  const double t1 = timeSpMV(du, x, y1, runs);
+  const double t2 = timeSpMV(vi, x, y2, runs);
+
+  cout << "27-point stencil  " << A.size1() << " rows  " << A.aa().size() << " nnz  "
+       << du.units() << " units" << endl;
+  cout << "CRS     : " << crsBytes/1e6        << " MB   " << t0 << " ms" << endl;
+  cout << "CSR-DU  : " << du.spmvBytes()/1e6  << " MB   " << t1 << " ms   bytes "
+       << 100.*du.spmvBytes()/crsBytes << " %   |dy| " << maxDiff(y0,y1) << endl;
+  cout << "CSR-VI  : " << vi.spmvBytes()/1e6  << " MB   " << t2 << " ms   bytes "
+       << 100.*vi.spmvBytes()/crsBytes << " %   |dy| " << maxDiff(y0,y2) << endl;
+  cout << "held    : CRS " << crsBytes/1e6 << " MB   CSR-DU " << du.storedBytes()/1e6
+       << " MB   CSR-VI " << vi.storedBytes()/1e6 << " MB" << endl;
+
+  return 0;
+}
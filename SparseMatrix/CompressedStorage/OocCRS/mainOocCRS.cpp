@@ -0,0 +1,142 @@
+# include <algorithm>
+# include <chrono>
+# include <random>
+# include "OocCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// 2D Laplacian n^2 x n^2 (5-point stencil) row by row : straight to the
+// panel file when w is given , in memory otherwise
+//
+template <typename Add>
+void laplacian2D(const std::size_t n, Add add)
+{
+    std::vector<std::size_t> ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < n ; i++)
+      for(std::size_t j=0 ; j < n ; j++)
+      {
+         const auto r = i*n + j ;
+         ja.clear(); aa.clear();
+         if(i > 0)   { ja.push_back(r-n); aa.push_back(-1.); }
+         if(j > 0)   { ja.push_back(r-1); aa.push_back(-1.); }
+         ja.push_back(r); aa.push_back(4. + 1e-3*(r % 7));
+         if(j+1 < n) { ja.push_back(r+1); aa.push_back(-1.); }
+         if(i+1 < n) { ja.push_back(r+n); aa.push_back(-1.); }
+         add(ja, aa);
+      }
+}
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+double maxDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double d = 0 ;
+    for(std::size_t i=0 ; i < a.size() ; i++) d = std::max(d, std::abs(a[i]-b[i]));
+    return d ;
+}
+
+
+int main(int argc, char** argv){
+
+   const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 700 ;
+
+   // Matrix Market -> panels without loading the matrix
+   writePanels<double>("mat003.mtx", "mat003.ooc", 2);
+   OocCRSmatrix<double> s("mat003.ooc");
+   cout << s.size1() << "x" << s.size2() << "  nnz " << s.nonZeros() << "  panels " << s.panels() << endl;
+   s.panel(1).print();
+   CRSmatrix<double> c("mat003.mtx");
+   const std::vector<double> x3{1., 2., 3., 4.} ;
+   cout << "|A x - ooc A x| " << maxDiff(c*x3, s*x3) << endl;
+   try {
+      s.panel(2);
+   }
+   catch(MatrixException& e) {
+      cout << e.what() << endl;
+   }
+   // panelRows 0 is taken as 1 , as by OocCRSwriter
+   writePanels<double>("mat003.mtx", "mat003.ooc", 0);
+   OocCRSmatrix<double> s0("mat003.ooc");
+   cout << "panelRows 0 : panels " << s0.panels() << "  |A x - ooc A x| " << maxDiff(c*x3, s0*x3) << endl;
+   std::remove("mat003.ooc");
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // generated straight to disk , never held in memory as a whole
+   {
+      OocCRSwriter<double> w("laplace.ooc", n*n, n*n, 1u << 16);
+      laplacian2D(n, [&](const std::vector<std::size_t>& ja, const std::vector<double>& aa){
+         w.addRow(ja.data(), aa.data(), ja.size());
+      });
+      w.close();
+   }
+
+   std::vector<std::size_t> ia{0} , ja ;
+   std::vector<double>      aa ;
+   laplacian2D(n, [&](const std::vector<std::size_t>& j, const std::vector<double>& a){
+      ja.insert(ja.end(), j.begin(), j.end());
+      aa.insert(aa.end(), a.begin(), a.end());
+      ia.push_back(ja.size());
+   });
+   const CRSmatrix<double> A(n*n, n*n, std::move(ia), std::move(ja), std::move(aa));
+
+   std::vector<double> x(A.size2());
+   for(std::size_t i=0 ; i < x.size() ; i++) x[i] = std::sin(0.001*i);
+
+   std::vector<double> y ;
+   const double tm = ms([&]{ y = A*x ; });
+   cout << A.size1() << " rows  nnz " << A.aa().size() << "   in memory SpMV " << tm << " ms" << endl;
+
+   // Matrix Market in random order -> panels : 64 KB of buckets , many flushes per panel
+   {
+      std::vector<std::size_t> order(A.aa().size());
+      std::vector<std::size_t> row(A.aa().size());
+      for(std::size_t i=0 ; i < A.size1() ; i++)
+         for(auto k=A.ia()[i] ; k < A.ia()[i+1] ; k++) row[k] = i ;
+      for(std::size_t k=0 ; k < order.size() ; k++) order[k] = k ;
+      std::shuffle(order.begin(), order.end(), std::mt19937(3));
+      {
+         std::ofstream f("laplace.mtx");
+         f << "%%MatrixMarket matrix coordinate real general\n" << A.size1() << ' ' << A.size2() << ' ' << order.size() << '\n' ;
+         f << std::setprecision(17);
+         for(auto k : order) f << row[k]+1 << ' ' << A.ja()[k]+1 << ' ' << A.aa()[k] << '\n' ;
+      }
+      double tw = ms([&]{ writePanels<double>("laplace.mtx", "laplace_mtx.ooc", 1u << 14, 1u << 16); });
+      OocCRSmatrix<double> B("laplace_mtx.ooc");
+      cout << "shuffled Matrix Market -> " << B.panels() << " panels  " << tw << " ms   |y - y_ooc| " << maxDiff(y, B*x) << endl;
+      std::remove("laplace.mtx");
+      std::remove("laplace_mtx.ooc");
+   }
+
+   // the panel file of the writer and the ones of writePanels , different panel sizes
+   cout << " panelRows  depth  panels      MB     ms    MB/s   read ms  compute ms  stall ms  |y - y_ooc|" << endl;
+   for(std::size_t pr : {1u << 12, 1u << 16, 1u << 20})
+   {
+      const std::string file = pr == (1u << 16) ? "laplace.ooc" : "laplace_" + std::to_string(pr) + ".ooc" ;
+      if(pr != (1u << 16)) writePanels(A, file, pr);
+
+      for(std::size_t depth : {2, 4})
+      {
+         OocCRSmatrix<double> B(file, depth);
+         std::vector<double> yo = B*x ;                    // warm the page cache
+         yo = B*x ;
+         const auto& st = B.stats();
+         cout << std::setw(10) << pr << std::setw(7) << depth << std::setw(8) << B.panels()
+              << std::setw(8) << std::setprecision(4) << st.bytes/1e6 << std::setw(7) << st.wall*1e3
+              << std::setw(8) << st.bandwidth()/1e6 << std::setw(10) << st.read*1e3 << std::setw(12) << st.compute*1e3
+              << std::setw(10) << st.stall*1e3 << "   " << maxDiff(y, yo) << endl;
+      }
+      std::remove(file.c_str());
+   }
+
+   return 0;
+}
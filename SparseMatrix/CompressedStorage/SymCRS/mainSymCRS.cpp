@@ -0,0 +1,105 @@
+# include <chrono>
+# include "SymCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// 3D Laplacian  n^3 x n^3  (7-point stencil)
+//
+CRSmatrix<double> laplacian3D(const std::size_t n)
+{
+    std::vector<std::size_t> ia{0} , ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < n ; i++)
+     for(std::size_t j=0 ; j < n ; j++)
+      for(std::size_t k=0 ; k < n ; k++)
+      {
+         const auto r = (i*n + j)*n + k ;
+         if(i > 0)   { ja.push_back(r-n*n); aa.push_back(-1.); }
+         if(j > 0)   { ja.push_back(r-n);   aa.push_back(-1.); }
+         if(k > 0)   { ja.push_back(r-1);   aa.push_back(-1.); }
+         ja.push_back(r); aa.push_back(6.);
+         if(k+1 < n) { ja.push_back(r+1);   aa.push_back(-1.); }
+         if(j+1 < n) { ja.push_back(r+n);   aa.push_back(-1.); }
+         if(i+1 < n) { ja.push_back(r+n*n); aa.push_back(-1.); }
+         ia.push_back(ja.size());
+      }
+    return CRSmatrix<double>(n*n*n, n*n*n, std::move(ia), std::move(ja), std::move(aa));
+}
+
+template <typename M>
+double timeSpMV(const M& A, const std::vector<double>& x, std::vector<double>& y, const std::size_t runs)
+{
+    y = A*x ;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t r=0 ; r < runs ; r++)
+       y = A*x ;
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()/runs*1e3 ;
+}
+
+double maxDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double d = 0 ;
+    for(std::size_t i=0 ; i < a.size() ; i++)
+       d = std::max(d, std::abs(a[i]-b[i]));
+    return d ;
+}
+
+
+int main(int argc, char** argv){
+
+  const std::size_t n    = argc > 1 ? std::stoul(argv[1]) : 60 ;
+  const std::size_t runs = argc > 2 ? std::stoul(argv[2]) : 20 ;
+
+  SymCRSmatrix<double> s1("sym001.mtx");
+  s1.printSymCRS();
+  s1.print();
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  CRSmatrix<double> c1("sym001.mtx");          // symmetric qualifier : both triangles
+  c1.print();
+  std::vector<double> x1 = {1.,2.,3.,4.,5.};
+  cout << "CRS  : " ;  for(auto v : c1*x1) cout << v << ' ' ;
+  cout << endl << "SCRS : " ;  for(auto v : s1*x1) cout << v << ' ' ;
+  cout << endl;
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  SymCRSmatrix<double> s2 = {{4,1,0},{1,5,2},{0,2,6}} ;
+  s2(3,1) = 7 ;                                 // sets a_31 and a_13
+  cout << s2 ;
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  try {
+     SymCRSmatrix<double> bad(CRSmatrix<double>("mat003.mtx"));
+  }
+  catch(MatrixException& e) {
+     cout << "mat003.mtx : " << e.what() << endl;
+  }
+  try {
+     CRSmatrix<double> bad("herm001.mtx");      // the mirror would need conj()
+  }
+  catch(MatrixException& e) {
+     cout << "herm001.mtx : " << e.what() << endl;
+  }
+  cout << "--------------------------------------------------------------------------------" << endl;
+
+  const auto A = laplacian3D(n);
+  const SymCRSmatrix<double> S(A);
+  const std::vector<double> x(A.size2(), 1.);
+  std::vector<double> y0 , y1 ;
+
+  const double crsBytes = A.aa().size()*(sizeof(double)+sizeof(std::size_t)) + A.ia().size()*sizeof(std::size_t) ;
+  const double symBytes = S.aa().size()*(sizeof(double)+sizeof(std::size_t)) +
+                          S.ia().size()*sizeof(std::size_t) + S.diag().size()*sizeof(double) ;
+  const double t0 = timeSpMV(A, x, y0, runs);
+  const double t1 = timeSpMV(S, x, y1, runs);
+
+  cout << "3D Laplacian " << A.size1() << " rows  nnz " << A.aa().size() << " / " << S.nonZeros() << endl;
+  cout << "CRS      : " << crsBytes/1e6 << " MB   " << t0 << " ms" << endl;
+  cout << "SymCRS   : " << symBytes/1e6 << " MB   " << t1 << " ms   bytes " << 100.*symBytes/crsBytes
+       << " %   |dy| " << maxDiff(y0,y1) << endl;
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+//  Strong scaling of the distributed SpMV : the global problem is fixed,
+//  run it with an increasing number of ranks
+//
+//  mpicxx -std=c++17 -O3 benchDistCRS.cpp -o benchdist
+//  for p in 1 2 4 8 ; do mpirun -np $p ./benchdist 100 200 ; done
+//
+//  args : grid size n (3D Laplacian with n^3 rows) , number of SpMV
+//
+# include "DistCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+int main(int argc, char** argv) {
+
+  MPI_Init(&argc, &argv);
+  int rank , nprocs ;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+
+  const std::size_t n    = argc > 1 ? std::stoul(argv[1]) : 64 ;
+  const std::size_t runs = argc > 2 ? std::stoul(argv[2]) : 100 ;
+  const std::size_t N    = n*n*n ;
+
+  // every rank builds only its own rows of the 7-point Laplacian
+  const auto begin = rowPartition(N, rank, nprocs);
+  const auto end   = rowPartition(N, rank+1, nprocs);
+
+  std::vector<std::size_t> ia(1,0), ja;
+  std::vector<double> aa;
+  for(auto r = begin ; r < end ; r++)
+  {
+     const auto i = r % n , j = (r/n) % n , k = r/(n*n) ;
+     if(k > 0)   { ja.push_back(r-n*n); aa.push_back(-1.); }
+     if(j > 0)   { ja.push_back(r-n);   aa.push_back(-1.); }
+     if(i > 0)   { ja.push_back(r-1);   aa.push_back(-1.); }
+                   ja.push_back(r);     aa.push_back( 6.);
+     if(i < n-1) { ja.push_back(r+1);   aa.push_back(-1.); }
+     if(j < n-1) { ja.push_back(r+n);   aa.push_back(-1.); }
+     if(k < n-1) { ja.push_back(r+n*n); aa.push_back(-1.); }
+     ia.push_back(ja.size());
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double t0 = MPI_Wtime();
+  DistCRSmatrix<double> A(MPI_COMM_WORLD, N, begin, std::move(ia), std::move(ja), std::move(aa));
+  double setup = MPI_Wtime() - t0 ;
+
+  std::vector<double> x(A.localRows(), 1.) , y ;
+  y = A * x ;                                   // warm up
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  t0 = MPI_Wtime();
+  for(std::size_t r=0 ; r < runs ; r++)
+  {
+     y = A * x ;
+     std::swap(x, y);
+  }
+  double elapsed = MPI_Wtime() - t0 ;
+
+  double maxElapsed = 0. , maxSetup = 0. ;
+  MPI_Reduce(&elapsed, &maxElapsed, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&setup,   &maxSetup,   1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  const auto nnz = A.nnz();
+
+  if(rank == 0)
+  {
+     const double perSpMV = maxElapsed / runs ;
+     cout << "ranks "       << setw(4)  << nprocs
+          << "  rows "      << setw(10) << N
+          << "  nnz "       << setw(10) << nnz
+          << "  setup [s] " << setw(10) << maxSetup
+          << "  SpMV [ms] " << setw(10) << 1.e3*perSpMV
+          << "  GFlop/s "   << setw(8)  << 2.*nnz/perSpMV*1.e-9 << endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+}
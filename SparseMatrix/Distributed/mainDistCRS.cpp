@@ -0,0 +1,97 @@
+//  mpicxx -std=c++17 mainDistCRS.cpp -o distcrs && mpirun -np 4 ./distcrs
+//
+# include "DistCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+// 2D Laplacian on a n x n grid plus a few long range couplings
+CRSmatrix<double> testMatrix(std::size_t n)
+{
+   const auto N = n*n ;
+   std::vector<std::size_t> ia(1,0), ja;
+   std::vector<double> aa;
+   for(std::size_t i=0 ; i < N ; i++)
+   {
+      std::vector<std::size_t> cols = { i };
+      if(i >= n)          cols.push_back(i-n);
+      if(i % n != 0)      cols.push_back(i-1);
+      if(i % n != n-1)    cols.push_back(i+1);
+      if(i + n < N)       cols.push_back(i+n);
+      if(i % 17 == 0)     cols.push_back((i*7919) % N);
+      std::sort(cols.begin(), cols.end());
+      cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+      for(auto c : cols)
+      {
+         ja.push_back(c);
+         aa.push_back(c == i ? 4. : -1. - 0.001*c);
+      }
+      ia.push_back(ja.size());
+   }
+   return CRSmatrix<double>(N, N, ia, ja, aa);
+}
+
+
+int main(int argc, char** argv) {
+
+  MPI_Init(&argc, &argv);
+  int rank , nprocs ;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+
+  const CRSmatrix<double> A = testMatrix(40);
+  DistCRSmatrix<double> dA(A);
+
+  std::vector<double> x(A.size2());
+  for(std::size_t i=0 ; i < x.size() ; i++) x[i] = std::cos(0.1*i) ;
+
+  std::vector<double> xloc(x.begin() + dA.rowBegin(), x.begin() + dA.rowEnd());
+  std::vector<double> yloc = dA * xloc ;
+  std::vector<double> y    = A * x ;
+
+  double err = 0. ;
+  for(std::size_t i=0 ; i < yloc.size() ; i++)
+     err = std::max(err, fabs(yloc[i] - y[dA.rowBegin()+i]));
+  double maxErr = 0. ;
+  MPI_Reduce(&err, &maxErr, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+  for(int p=0 ; p < nprocs ; p++)
+  {
+     if(p == rank)
+        cout << "rank " << rank << "  rows [" << dA.rowBegin() << "," << dA.rowEnd() << ")"
+             << "  diag nnz " << dA.diag().nnz_() << "  off-diag nnz " << dA.offDiag().nnz_()
+             << "  ghosts " << dA.numGhosts() << "  neighbours " << dA.numNeighbours() << endl;
+     MPI_Barrier(MPI_COMM_WORLD);
+  }
+  const auto nnz = dA.nnz();
+  if(rank == 0)
+  {
+     cout << "----------------------------------------------------------" << endl;
+     cout << "global nnz " << nnz << " (serial " << A.nnz_() << ")" << endl;
+     cout << "max |y_dist - y_serial| : " << maxErr << endl;
+  }
+
+  // a bad partition on one rank only : every rank throws , none hangs
+  {
+     const auto begin = rowPartition(A.size1(), rank, nprocs) , end = rowPartition(A.size1(), rank+1, nprocs) ;
+     std::vector<std::size_t> lia(end-begin+1);
+     for(auto i = begin ; i <= end ; i++) lia[i-begin] = A.ia()[i] - A.ia()[begin] ;
+     std::vector<std::size_t> lja(A.ja().begin() + A.ia()[begin], A.ja().begin() + A.ia()[end]);
+     std::vector<double>      laa(A.aa().begin() + A.ia()[begin], A.aa().begin() + A.ia()[end]);
+     if(rank == nprocs-1) lja.back() = A.size2() ;        // column out of range
+     int thrown = 0 , all = 0 ;
+     try {
+        DistCRSmatrix<double> bad(MPI_COMM_WORLD, A.size1(), begin, lia, lja, laa);
+     }
+     catch(MatrixException& e) {
+        thrown = 1 ;
+        if(rank == 0 || rank == nprocs-1) cout << "rank " << rank << " : " << e.what() << endl;
+     }
+     MPI_Reduce(&thrown, &all, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+     if(rank == 0) cout << all << " of " << nprocs << " ranks threw" << endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,130 @@
+# include <chrono>
+# include "Lanczos.H"
+# include "LOBPCG.H"
+# include "../CompressedStorage/SymCRS/SymCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// 2D Laplacian  nx*ny x nx*ny  (5-point stencil , Dirichlet)
+//
+CRSmatrix<double> laplacian2D(const std::size_t nx, const std::size_t ny)
+{
+    std::vector<std::size_t> ia{0} , ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < nx ; i++)
+      for(std::size_t j=0 ; j < ny ; j++)
+      {
+         const auto r = i*ny + j ;
+         if(i > 0)    { ja.push_back(r-ny); aa.push_back(-1.); }
+         if(j > 0)    { ja.push_back(r-1);  aa.push_back(-1.); }
+         ja.push_back(r); aa.push_back(4.);
+         if(j+1 < ny) { ja.push_back(r+1);  aa.push_back(-1.); }
+         if(i+1 < nx) { ja.push_back(r+ny); aa.push_back(-1.); }
+         ia.push_back(ja.size());
+      }
+    return CRSmatrix<double>(nx*ny, nx*ny, std::move(ia), std::move(ja), std::move(aa));
+}
+
+// 4 - 2 cos(i pi/(nx+1)) - 2 cos(j pi/(ny+1)) , ascending
+// ( nx != ny : no multiple eigenvalues , single vector Lanczos finds one
+//   copy of a multiple eigenvalue , the LOBPCG block finds all )
+//
+std::vector<double> exactEigen(const std::size_t nx, const std::size_t ny)
+{
+    std::vector<double> l ;
+    for(std::size_t i=1 ; i <= nx ; i++)
+       for(std::size_t j=1 ; j <= ny ; j++)
+          l.push_back(4. - 2.*std::cos(i*M_PI/(nx+1)) - 2.*std::cos(j*M_PI/(ny+1)));
+    std::sort(l.begin(), l.end());
+    return l ;
+}
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+void report(const std::string& name, const EigenInfo& info, const std::vector<double>& l,
+            const std::vector<double>& exact, const bool largest, const double t)
+{
+    double err = 0 ;
+    for(std::size_t i=0 ; i < l.size() ; i++)
+       err = std::max(err, std::abs(l[i] - (largest ? exact[exact.size()-1-i] : exact[i])));
+    cout << name << " : " ;
+    for(auto x : l) cout << x << ' ' ;
+    cout << "  |l - exact| " << err << "   iterations " << info.iterations << "  matvecs " << info.matvecs
+         << "  converged " << info.converged << "   " << t << " ms" << endl;
+}
+
+
+int main(int argc, char** argv){
+
+   const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 60 ;
+
+   const auto A     = laplacian2D(n, n*3/4+1);
+   const auto exact = exactEigen(n, n*3/4+1);
+   cout << "2D Laplacian " << A.size1() << " rows  nnz " << A.aa().size() << endl;
+
+   EigenOptions opt ;
+   opt.nev = 4 ;
+   opt.tolerance = 1e-8 ;
+
+   std::vector<double> l ;
+   BlockVector<double> X ;
+   EigenInfo info ;
+   double t ;
+
+   t = ms([&]{ info = lanczos(A, l, X, opt); });
+   report("lanczos smallest", info, l, exact, false, t);
+
+   // Ritz vectors : X^T X = I , X^T A X = diag(l)
+   const auto G  = gram(X, X);
+   const auto GA = gram(X, spmm(A, X));
+   double orth = 0 ;
+   for(std::size_t i=1 ; i <= G.size1() ; i++)
+      for(std::size_t j=1 ; j <= G.size2() ; j++)
+         orth = std::max({orth, std::abs(G(i,j) - (i == j)), std::abs(GA(i,j) - (i == j ? l[i-1] : 0.))});
+   cout << "|X^T X - I| , |X^T A X - L| : " << orth << endl;
+
+   X = BlockVector<double>() ;
+   t = ms([&]{ info = lobpcg(A, l, X, opt); });
+   report("lobpcg  smallest", info, l, exact, false, t);
+
+   opt.blockSize = 8 ;                            // 4 guard vectors
+   X = BlockVector<double>() ;
+   t = ms([&]{ info = lobpcg(A, l, X, opt); });
+   report("lobpcg  block 8 ", info, l, exact, false, t);
+   opt.blockSize = 0 ;
+
+   opt.which = EigenWhich::Largest ;
+   t = ms([&]{ info = lanczos(A, l, X, opt); });
+   report("lanczos largest ", info, l, exact, true, t);
+   X = BlockVector<double>() ;
+   t = ms([&]{ info = lobpcg(A, l, X, opt); });
+   report("lobpcg  largest ", info, l, exact, true, t);
+
+   // any format : symmetric half storage , SpMM falls back to one SpMV per column
+   const SymCRSmatrix<double> S(A);
+   t = ms([&]{ info = lanczos(S, l, X, opt); });
+   report("lanczos SymCRS  ", info, l, exact, true, t);
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // cost of a Lanczos step ( SpMV + reorthogonalization ) against nnz ,
+   // the number of steps depends on the spectral gaps , not on the format
+   cout << "rows        nnz   matvecs    ms/pair   us/matvec/Mnnz" << endl;
+   for(std::size_t g : {50, 100, 200})
+   {
+      const auto B = laplacian2D(g, g*3/4+1);
+      t = ms([&]{ info = lanczos(B, l, X, opt); });
+      cout << std::setw(8) << B.size1() << std::setw(10) << B.aa().size() << std::setw(10) << info.matvecs
+           << std::setw(11) << t/opt.nev << std::setw(12) << 1e3*t/info.matvecs/(B.aa().size()/1e6) << endl;
+   }
+
+   return 0;
+}
@@ -0,0 +1,214 @@
+# include <chrono>
+# include <queue>
+# include <random>
+# include "GraphAlgorithms.H"
+# include "../UncompressedStorage/COO/COOmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// undirected triangulated g x g grid cut in 3 horizontal bands + g*g/2
+// random shortcuts inside each band : 3 components , small diameter ,
+// weights in [1,10)
+//
+COOmatrix<double> bandedSmallWorld(const std::size_t g, const unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> w(1., 10.);
+    std::vector<std::size_t> ia , ja ;
+    std::vector<double>      aa ;
+    auto edge = [&](const std::size_t u, const std::size_t v){
+       const double c = w(gen);
+       ia.push_back(u); ja.push_back(v); aa.push_back(c);
+       ia.push_back(v); ja.push_back(u); aa.push_back(c);
+    };
+    auto band = [&](const std::size_t r){ return r*3/g ; };
+
+    for(std::size_t r=0 ; r < g ; r++)
+      for(std::size_t c=0 ; c < g ; c++)
+      {
+         if(c+1 < g)                       edge(r*g + c, r*g + c+1);
+         if(r+1 < g && band(r) == band(r+1)) edge(r*g + c, (r+1)*g + c);
+         if(r+1 < g && c+1 < g && band(r) == band(r+1)) edge(r*g + c, (r+1)*g + c+1);
+      }
+    std::uniform_int_distribution<std::size_t> any(0, g*g-1);
+    for(std::size_t k=0 ; k < g*g/2 ; k++)
+    {
+       const auto u = any(gen) , v = any(gen) ;
+       if(u != v && band(u/g) == band(v/g)) edge(u, v);
+    }
+    return COOmatrix<double>(g*g, g*g, std::move(ia), std::move(ja), std::move(aa));
+}
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+// push*3 pull*4 push*9 ...
+std::string runs(const std::vector<Direction>& t)
+{
+    std::string s ;
+    for(std::size_t k=0 ; k < t.size() ; )
+    {
+       std::size_t e = k ;
+       while(e < t.size() && t[e] == t[k]) e++ ;
+       s += (t[k] == Direction::Push ? "push*" : "pull*") + std::to_string(e-k) + " " ;
+       k = e ;
+    }
+    return s ;
+}
+
+
+int main(int argc, char** argv){
+
+   const std::size_t g = argc > 1 ? std::stoul(argv[1]) : 400 ;
+
+   // the same semirings on a small matrix
+   CRSmatrix<double> s = {{0,2,0,0},{0,0,3,0},{0,0,0,1},{4,0,0,0}} ;
+   const auto s2 = mxm<PlusTimes<double>>(s, s);
+   s2.print();
+   (s*s).print();
+   const auto r2 = mxm<OrAnd<>>(s, s);
+   cout << "2-step reachability nnz " << r2.aa().size() << "   min-plus 1 hop from 0 : " ;
+   for(auto v : mxv<MinPlus<double>>(s, std::vector<double>{0, semiringInfinity<double>(), semiringInfinity<double>(), semiringInfinity<double>()}))
+      cout << v << ' ' ;
+   cout << "  max-times : " ;
+   for(auto v : mxv<MaxTimes<double>>(s, std::vector<double>{.5, .5, .5, .5})) cout << v << ' ' ;
+   cout << endl << "--------------------------------------------------------------------------------" << endl;
+
+   const auto coo = bandedSmallWorld(g, 7);
+   const auto A   = toCRS(coo);
+   const auto At  = toCCS(coo);
+   const std::size_t n = A.size1();
+   cout << n << " vertices  " << A.aa().size() << " directed edges" << endl;
+
+   // plus-times pull on CRS and push on CCS against the numeric SpMV
+   std::vector<double> x(n);
+   for(std::size_t i=0 ; i < n ; i++) x[i] = std::sin(0.1*i);
+   const auto y  = A*x ;
+   const auto yl = mxv<PlusTimes<double>>(A, x);
+   const auto yp = mxv<PlusTimes<double>>(At, SparseVector<double>::fromDense(x, 0.)).toDense(0.);
+   double e1 = 0 , e2 = 0 ;
+   for(std::size_t i=0 ; i < n ; i++) { e1 = std::max(e1, std::abs(y[i]-yl[i])); e2 = std::max(e2, std::abs(y[i]-yp[i])); }
+   cout << "|A x - pull| " << e1 << "   |A x - push| " << e2 << endl;
+
+   double tm = 0 , tp = 0 ;
+   for(int r=0 ; r < 10 ; r++) tm += ms([&]{ auto z = A*x ; });
+   for(int r=0 ; r < 10 ; r++) tp += ms([&]{ auto z = mxv<PlusTimes<double>>(A, x) ; });
+   cout << "SpMV " << tm/10 << " ms   plus-times pull " << tp/10 << " ms" << endl;
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // BFS against a queue
+   std::vector<std::ptrdiff_t> ref(n, -1);
+   {
+      std::queue<std::size_t> q ;
+      ref[0] = 0 ; q.push(0);
+      while(!q.empty())
+      {
+         const auto u = q.front(); q.pop();
+         for(auto k=A.ia()[u] ; k < A.ia()[u+1] ; k++)
+            if(ref[A.ja()[k]] < 0) { ref[A.ja()[k]] = ref[u] + 1 ; q.push(A.ja()[k]); }
+      }
+   }
+   const SemiringOperator<double> G(A, At) , Gs(A) ;
+   for(auto d : {Direction::Auto, Direction::Push, Direction::Pull})
+   {
+      std::vector<Direction> trace ;
+      std::vector<std::ptrdiff_t> level ;
+      const double t = ms([&]{ level = bfs(G, 0, d, &trace); });
+      cout << "bfs " << (d == Direction::Auto ? "auto" : d == Direction::Push ? "push" : "pull") << "  "
+           << std::setw(9) << t << " ms   levels " << trace.size() << "   same as queue " << (level == ref) << endl;
+      if(d == Direction::Auto) cout << "     " << runs(trace) << endl;
+   }
+   cout << "bfs symmetric operator (CRS as CCS) same as queue " << (bfs(Gs, 0) == ref) << endl;
+   try {
+      const CRSmatrix<double> W(2, 2, {0,1,2}, {1,0}, {1.,2.}) ;   // pattern of its transpose , not the values
+      const SemiringOperator<double> Gw(W) ;
+   }
+   catch(MatrixException& e) {
+      cout << e.what() << endl;
+   }
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // shortest paths against Dijkstra
+   std::vector<double> dref(n, semiringInfinity<double>());
+   {
+      using Item = std::pair<double , std::size_t> ;
+      std::priority_queue<Item, std::vector<Item>, std::greater<Item>> q ;
+      dref[0] = 0 ; q.push({0., 0});
+      while(!q.empty())
+      {
+         const auto [du, u] = q.top(); q.pop();
+         if(du > dref[u]) continue ;
+         for(auto k=A.ia()[u] ; k < A.ia()[u+1] ; k++)
+         {
+            const auto v = A.ja()[k] ;
+            if(du + A.aa()[k] < dref[v]) { dref[v] = du + A.aa()[k] ; q.push({dref[v], v}); }
+         }
+      }
+   }
+   std::vector<double> dist ;
+   const double ts = ms([&]{ dist = shortestPaths(G, 0); });
+   double ed = 0 ;
+   std::size_t reached = 0 ;
+   for(std::size_t i=0 ; i < n ; i++)
+   {
+      if(dref[i] == semiringInfinity<double>()) { ed = std::max(ed, dist[i] == dref[i] ? 0. : 1.); continue ; }
+      ed = std::max(ed, std::abs(dist[i] - dref[i]));
+      reached++ ;
+   }
+   cout << "shortest paths " << ts << " ms   reached " << reached << "   |d - dijkstra| " << ed << endl;
+
+   // connected components against union-find
+   std::vector<std::size_t> parent(n);
+   for(std::size_t i=0 ; i < n ; i++) parent[i] = i ;
+   auto find = [&](std::size_t i){ while(parent[i] != i) i = parent[i] = parent[parent[i]] ; return i ; };
+   for(std::size_t i=0 ; i < n ; i++)
+      for(auto k=A.ia()[i] ; k < A.ia()[i+1] ; k++)
+      {
+         const auto a = find(i) , b = find(A.ja()[k]) ;
+         if(a != b) parent[std::max(a, b)] = std::min(a, b) ;
+      }
+   std::vector<std::size_t> label ;
+   const double tc = ms([&]{ label = connectedComponents(Gs); });
+   std::size_t comps = 0 ;
+   bool same = true ;
+   for(std::size_t i=0 ; i < n ; i++)
+   {
+      comps += label[i] == i ;
+      same = same && label[i] == find(i) ;
+   }
+   cout << "components " << comps << "   " << tc << " ms   same as union-find " << same << endl;
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // triangles : (A A) masked by A , plus-times on the pattern
+   std::vector<double> ones(A.aa().size(), 1.);
+   const CRSmatrix<double> P(n, n, std::vector<std::size_t>(A.ia().begin(), A.ia().end()),
+                             std::vector<std::size_t>(A.ja().begin(), A.ja().end()), ones);
+   CRSmatrix<double> C(0, 0) ;
+   const double tt = ms([&]{ C = mxm<PlusTimes<double>>(P, P, P); });
+   double tri = 0 ;
+   for(auto v : C.aa()) tri += v ;
+   std::size_t tref = 0 ;                       // i < j < k , sorted neighbour lists
+   for(std::size_t i=0 ; i < n ; i++)
+      for(auto p=A.ia()[i] ; p < A.ia()[i+1] ; p++)
+      {
+         const auto j = A.ja()[p] ;
+         if(j <= i) continue ;
+         auto u = A.ja().begin() + A.ia()[i] , v = A.ja().begin() + A.ia()[j] ;
+         const auto ue = A.ja().begin() + A.ia()[i+1] , ve = A.ja().begin() + A.ia()[j+1] ;
+         while(u != ue && v != ve)
+         {
+            if(*u < *v) ++u ; else if(*v < *u) ++v ; else { tref += *u > j ; ++u ; ++v ; }
+         }
+      }
+   cout << "triangles " << tri/6 << " (merge count " << tref << ")   masked SpGEMM " << tt << " ms   nnz(C) " << C.aa().size() << endl;
+
+   return 0;
+}
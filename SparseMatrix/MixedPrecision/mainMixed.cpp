@@ -0,0 +1,67 @@
+# include "IterativeRefinement.H"
+# include "../BlockedStorage/BCRS/BCRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+// 2D Laplacian on a n x n grid  (SPD)
+CRSmatrix<double> laplace2d(std::size_t n)
+{
+   std::vector<std::size_t> ia(1,0), ja;
+   std::vector<double> aa;
+   for(std::size_t i=0 ; i < n*n ; i++)
+   {
+      if(i >= n)          { ja.push_back(i-n); aa.push_back(-1.); }
+      if(i % n != 0)      { ja.push_back(i-1); aa.push_back(-1.); }
+                            ja.push_back(i);   aa.push_back( 4.1); 
+      if(i % n != n-1)    { ja.push_back(i+1); aa.push_back(-1.); }
+      if(i + n < n*n)     { ja.push_back(i+n); aa.push_back(-1.); }
+      ia.push_back(ja.size());
+   }
+   return CRSmatrix<double>(n*n, n*n, ia, ja, aa);
+}
+
+
+int main() {
+
+  CRSmatrix<double>   A  = laplace2d(64);
+  CRSmatrix<float>    Af(A);            // half the value bytes
+  CRSmatrix<bfloat16> Ab(A);            // a quarter of the value bytes
+
+  std::vector<double> x(A.size2());
+  for(std::size_t i=0 ; i < x.size() ; i++) x[i] = std::sin(0.01*i) ;
+
+  std::vector<double> y  = A  * x ;
+  std::vector<double> yf = Af * x ;     // float values , double accumulation
+  std::vector<double> yb = Ab * x ;
+  
+  axpy(-1., y, yf);
+  axpy(-1., y, yb);
+  cout << "SpMV  |y_float - y| / |y| : " << norm2(yf)/norm2(y) << endl;
+  cout << "SpMV  |y_bf16  - y| / |y| : " << norm2(yb)/norm2(y) << endl;
+  cout << "----------------------------------------------------------" << endl;   
+
+  BCRSmatrix<double,2,2> B(A);
+  BCRSmatrix<float,2,2>  Bf(B);
+  std::vector<double> z  = B  * x ;
+  std::vector<double> zf = Bf * x ;
+  axpy(-1., z, zf);
+  cout << "BCRS  |z_float - z| / |z| : " << norm2(zf)/norm2(z) << endl;
+  cout << "----------------------------------------------------------" << endl;   
+
+  std::vector<double> b = y , sol ;
+  
+  auto info = iterativeRefinement(A, Af, b, sol);
+  axpy(-1., x, sol);
+  cout << "IR (float)  refinements : " << info.refinements << "  inner CG : " << info.innerIterations 
+       << "  residual : " << info.residual << "  error : " << norm2(sol)/norm2(x) << endl;
+
+  sol.clear();
+  info = iterativeRefinement(A, Ab, b, sol);
+  axpy(-1., x, sol);
+  cout << "IR (bf16)   refinements : " << info.refinements << "  inner CG : " << info.innerIterations 
+       << "  residual : " << info.residual << "  error : " << norm2(sol)/norm2(x) << endl;
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+# include <chrono>
+# include <random>
+# include "COOmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// random triplets around the diagonal, ~10% duplicated coordinates
+//
+COOmatrix<double> randomCOO(const std::size_t n, const std::size_t perRow)
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long> off(-50, 50);
+    std::uniform_real_distribution<double> val(-1., 1.);
+
+    std::vector<std::size_t> ri , ci ;
+    std::vector<double>      v ;
+    for(std::size_t i=0 ; i < n ; i++)
+       for(std::size_t k=0 ; k < perRow ; k++)
+       {
+          const long j = std::min(std::max(long(i) + off(gen), 0l), long(n)-1);
+          ri.push_back(i); ci.push_back(j); v.push_back(val(gen));
+          if(k % 10 == 0) { ri.push_back(i); ci.push_back(j); v.push_back(val(gen)); }
+       }
+    // ingest order : shuffled
+    std::vector<std::size_t> p(v.size());
+    std::iota(p.begin(), p.end(), 0);
+    std::shuffle(p.begin(), p.end(), gen);
+    std::vector<std::size_t> rs(p.size()) , cs(p.size());
+    std::vector<double>      vs(p.size());
+    for(std::size_t k=0 ; k < p.size() ; k++) { rs[k] = ri[p[k]]; cs[k] = ci[p[k]]; vs[k] = v[p[k]]; }
+
+    return COOmatrix<double>(n, n, std::move(rs), std::move(cs), std::move(vs));
+}
+
+double maxDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double d = 0 ;
+    for(std::size_t i=0 ; i < a.size() ; i++)
+       d = std::max(d, std::abs(a[i]-b[i]));
+    return d ;
+}
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+
+int main(int argc, char** argv){
+
+   const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 200000 ;
+
+   // small rectangular case : y has size1() entries
+   COOmatrix<double> r(3, 5, {2,0,1,0,2,0}, {4,1,3,1,0,3}, {1.,2.,3.,4.,5.,6.});
+   std::vector<double> x5 = {1.,1.,1.,1.,1.};
+   cout << "unsorted  y : " ; for(auto v : r*x5) cout << v << ' ' ; cout << endl;
+   r.sort();
+   r.printCOO();
+   cout << "row-major y : " ; for(auto v : r*x5) cout << v << ' ' ; cout << endl;
+   toCRS(r).print();
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   COOmatrix<double> coo = randomCOO(n, 12);
+   const std::vector<double> x(n, 1.);
+   cout << "random COO " << n << " x " << n << "   triplets : " << coo.aa().size() << endl;
+
+   std::vector<double> yu , ys , ym ;
+   cout << "SpMV unsorted          : " << ms([&]{ yu = coo*x ; }) << " ms" << endl;
+
+   COOmatrix<double> morton = coo ;
+   cout << "radix sort (Morton)    : " << ms([&]{ morton.sort(CooOrder::Morton); }) << " ms" << endl;
+   cout << "SpMV Morton            : " << ms([&]{ ym = morton*x ; }) << " ms   |dy| " << maxDiff(yu,ym) << endl;
+
+   cout << "radix sort (row-major) : " << ms([&]{ coo.sort(); }) << " ms   merged to " << coo.aa().size() << endl;
+   cout << "SpMV segmented         : " << ms([&]{ ys = coo*x ; }) << " ms   |dy| " << maxDiff(yu,ys) << endl;
+
+   std::unique_ptr<CRSmatrix<double>> crs ;
+   std::unique_ptr<CCSmatrix<double>> ccs ;
+   cout << "COO -> CRS             : " << ms([&]{ crs = std::make_unique<CRSmatrix<double>>(toCRS(morton)); }) << " ms" << endl;
+   cout << "COO -> CCS             : " << ms([&]{ ccs = std::make_unique<CCSmatrix<double>>(toCCS(morton)); }) << " ms" << endl;
+   cout << "|y_crs - y| : " << maxDiff(ys, (*crs)*x) << "   |y_ccs - y| : " << maxDiff(ys, (*ccs)*x) << endl;
+
+   return 0;
+}
@@ -0,0 +1,97 @@
+# include <chrono>
+# include "HYBmatrix.H"
+# include "../../Analysis/FormatSelector.H"
+
+using namespace std;
+using namespace mg::numeric::algebra;
+
+
+// 2D Laplacian n^2 x n^2 (5-point stencil) plus c constraint rows : each
+// one couples every stride-th unknown , as Lagrange multipliers on a mesh
+//
+CRSmatrix<double> meshWithConstraints(const std::size_t n, const std::size_t c, const std::size_t stride)
+{
+    std::vector<std::size_t> ia{0} , ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < n ; i++)
+      for(std::size_t j=0 ; j < n ; j++)
+      {
+         const auto r = i*n + j ;
+         if(i > 0)   { ja.push_back(r-n); aa.push_back(-1.); }
+         if(j > 0)   { ja.push_back(r-1); aa.push_back(-1.); }
+         ja.push_back(r); aa.push_back(4.);
+         if(j+1 < n) { ja.push_back(r+1); aa.push_back(-1.); }
+         if(i+1 < n) { ja.push_back(r+n); aa.push_back(-1.); }
+         ia.push_back(ja.size());
+      }
+    for(std::size_t k=0 ; k < c ; k++)
+    {
+      for(std::size_t j=k ; j < n*n ; j += stride) { ja.push_back(j); aa.push_back(1./(k+1)); }
+      ia.push_back(ja.size());
+    }
+    return CRSmatrix<double>(n*n + c, n*n, std::move(ia), std::move(ja), std::move(aa));
+}
+
+template <typename M>
+double timeSpMV(const M& A, const std::vector<double>& x, std::vector<double>& y, const std::size_t runs)
+{
+    y = A*x ;
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t r=0 ; r < runs ; r++)
+       y = A*x ;
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 / runs ;
+}
+
+
+int main(int argc, char** argv){
+
+   const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 600 ;
+
+   // small : K = 2 , the 4 entries of row 5 past K in the tail
+   CRSmatrix<double> s = {{1,0,2,0,0,0},{0,3,0,0,0,0},{4,0,5,0,0,0},{0,0,0,6,0,7},{8,9,1,2,3,4}} ;
+   HYBmatrix<double> h(s);
+   cout << "K " << h.width() << "  tail " << h.tail().aa().size() << " entries in " << h.tailRows() << " rows" << endl;
+   cout << h ;
+   cout << "h(5,6) " << h(5,6) << "   h(4,5) " << h(4,5) << endl;
+   for(auto v : h * std::vector<double>{1,1,1,1,1,1}) cout << v << ' ' ;
+   cout << endl;
+
+   // K given : 0 (all in the tail) , 1 , the longest row (no tail)
+   for(std::size_t k : {0, 1, 6})
+   {
+      const auto hk = HYBmatrix<double>::withWidth(s, k);
+      const std::vector<double> x6{1,2,3,4,5,6} ;
+      const auto yc = s*x6 , yh = hk*x6 ;
+      double e = 0 ;
+      for(std::size_t i=0 ; i < yc.size() ; i++) e = std::max(e, std::abs(yc[i]-yh[i]));
+      cout << "withWidth(" << k << ")  K " << hk.width() << "  tail " << hk.tail().aa().size()
+           << "  |y_crs - y_hyb| " << e << endl;
+   }
+   cout << "--------------------------------------------------------------------------------" << endl;
+
+   // mesh + 16 constraint rows of n^2/64 entries
+   const auto A = meshWithConstraints(n, 16, 64);
+   const auto p = profile(A);
+   cout << A.size1() << " rows  nnz " << p.nnz << "  row length " << p.minRow << ".." << p.maxRow << endl;
+
+   std::vector<double> x(A.size2()) , y , yh ;
+   for(std::size_t i=0 ; i < x.size() ; i++) x[i] = std::cos(0.01*i);
+
+   const HYBmatrix<double> H(A);
+   cout << "HYB  K " << H.width() << "  ELL slots " << H.ellSlots() << "  tail " << H.tail().aa().size()
+        << " in " << H.tailRows() << " rows" << endl;
+   cout << "ELL would pad to " << p.maxRow << " : " << double(A.size1())*p.maxRow << " slots" << endl;
+
+   const double tc = timeSpMV(A, x, y, 20);
+   const double th = timeSpMV(H, x, yh, 20);
+   double err = 0 ;
+   for(std::size_t i=0 ; i < y.size() ; i++) err = std::max(err, std::abs(y[i]-yh[i]));
+   cout << "SpMV  CRS " << tc << " ms   HYB " << th << " ms   |y_crs - y_hyb| " << err << endl;
+
+   for(auto f : {StorageFormat::CRS, StorageFormat::ELL, StorageFormat::HYB})
+      cout << std::setw(5) << toString(f) << " predicted MB " << predictedBytes<double>(p, f)/1e6 << endl;
+   cout << "selected : " << toString(selectFormat(A)) << endl;
+
+   return 0;
+}
@@ -12,6 +12,47 @@ int main() {
                               {41,42,43,44,45,46,47,48}, {51,52,53,54,55,56,57,58},{61,62,63,64,65,66,67,68},{71,72,73,74,75,76,77,78},{81,82,83,84,85,86,87,88}};
  
 
+  // expression templates , move and compound operators against element-wise loops
+  {
+     const matrix<double> a = {{1.01,0,3.43, 0}, {0,4.07,0,0}, {0,0,0,3.09}, {1.0,2.4,0,0}} ;
+     const matrix<double> b = {{0,0,1.21,0}, {3.31,0,0,0}, {0,0,0,-6.11}, {1.0,2.2,0,0}} ;
+     const matrix<double> c = a * 2.0 ;
+
+     auto diff = [&](const matrix<double>& m, auto ref){
+        double d = 0 ;
+        for(std::size_t i=1 ; i <= 4 ; i++)
+           for(std::size_t j=1 ; j <= 4 ; j++)
+              d = std::max(d, std::abs(m(i,j) - ref(i,j)));
+        return d ;
+     };
+
+     matrix<double> f(4,4) ;
+     f = a + b*2.0 - c/4.0 ;                        // single fused loop, no temporaries
+     cout << "fused a + 2b - c/4     |e| "
+          << diff(f, [&](std::size_t i, std::size_t j){ return a(i,j) + b(i,j)*2.0 - c(i,j)/4.0 ; }) << endl;
+
+     f = f + a ;                                    // destination inside the expression
+     cout << "aliased f = f + a      |e| "
+          << diff(f, [&](std::size_t i, std::size_t j){ return (a(i,j) + b(i,j)*2.0 - c(i,j)/4.0) + a(i,j) ; }) << endl;
+
+     matrix<double> g = a ;
+     matrix<double>& r = ((g += b) -= a) *= 3.0 ;    // compound operators return *this
+     r /= 2.0 ;
+     cout << "((g += b) -= a) *= 3 , /= 2  same object " << (&r == &g) << "  |e| "
+          << diff(g, [&](std::size_t i, std::size_t j){ return ((a(i,j) + b(i,j)) - a(i,j))*3.0/2.0 ; }) << endl;
+
+     matrix<double> t = a ;
+     matrix<double> mv(std::move(t));
+     cout << "move ctor    " << mv.size1() << "x" << mv.size2() << " from " << t.size1() << "x" << t.size2()
+          << "  |e| " << diff(mv, [&](std::size_t i, std::size_t j){ return a(i,j) ; }) << endl;
+
+     matrix<double> ma(2,2) ;
+     ma = std::move(mv) ;
+     cout << "move assign  " << ma.size1() << "x" << ma.size2() << " from " << mv.size1() << "x" << mv.size2()
+          << "  |e| " << diff(ma, [&](std::size_t i, std::size_t j){ return a(i,j) ; }) << endl;
+  }
+  cout << "------------------------------------------------------------------------------------" <<endl;
+
   m1.print();
   cout << "------------------------------------------------------------------------------------" <<endl;
   cout << m01;
@@ -62,6 +103,10 @@ int main() {
   matrix<double> m10 = m5 * 2.0 ;
   cout << m10;
   cout << "------------------------------------------------------------------------------------" <<endl;
+  
+  matrix<double> m12 = m5 + m6*2.0 - m10/4.0 ;   // single fused loop, no temporaries
+  cout << m12;
+  cout << "------------------------------------------------------------------------------------" <<endl;
 
   matrix<int> m9 = m1*m01  ;
  // strassen(m1,m01,m9,8) ;
@@ -0,0 +1,81 @@
+# include <chrono>
+# include "CompressedStorage/CRS/CRSmatrix.H"
+# include "ThreadAffinity.H"
+
+using namespace mg::numeric::algebra ;
+
+// 2D Laplacian  n^2 x n^2  (5-point stencil)
+//
+CRSmatrix<double> laplacian(const std::size_t n)
+{
+    std::vector<std::size_t> ia{0} , ja ;
+    std::vector<double>      aa ;
+    for(std::size_t i=0 ; i < n ; i++)
+       for(std::size_t j=0 ; j < n ; j++)
+       {
+          const auto r = i*n + j ;
+          if(i > 0)   { ja.push_back(r-n); aa.push_back(-1.); }
+          if(j > 0)   { ja.push_back(r-1); aa.push_back(-1.); }
+          ja.push_back(r); aa.push_back(4.);
+          if(j+1 < n) { ja.push_back(r+1); aa.push_back(-1.); }
+          if(i+1 < n) { ja.push_back(r+n); aa.push_back(-1.); }
+          ia.push_back(ja.size());
+       }
+    return CRSmatrix<double>(n*n, n*n, std::move(ia), std::move(ja), std::move(aa));
+}
+
+
+int main(int argc, char** argv)
+{
+    const std::size_t n    = argc > 1 ? std::stoul(argv[1]) : 1000 ;
+    const std::size_t runs = argc > 2 ? std::stoul(argv[2]) : 20 ;
+
+    std::cout << "numa nodes : " << numaNodes() << "   threads : " << numThreads() << std::endl;
+
+    const bool pinned = pinThreads(ThreadBinding::Scatter);
+    std::cout << "pinned (scatter) : " << std::boolalpha << pinned << "   cpus :" ;
+    for(auto c : threadCpus())
+       std::cout << ' ' << c ;
+    std::cout << std::endl;
+
+    // a moved matrix keeps its placed buffers (DistCRS diag_ , HYB tail_)
+    static_assert(std::is_nothrow_move_assignable<CRSmatrix<double>>::value, "CRSmatrix move");
+    {
+       auto B = laplacian(64);
+       const auto* aa = B.aa().data();
+       CRSmatrix<double> C(std::move(B));
+       const bool ctor = C.aa().data() == aa ;
+       B = std::move(C);
+       std::cout << "move keeps the buffers : " << std::boolalpha << (ctor && B.aa().data() == aa) << std::endl;
+    }
+
+    std::vector<double> ref ;
+    const std::pair<MemoryPlacement , std::string> placements[] = {
+          { MemoryPlacement::Default    , "default    " } ,
+          { MemoryPlacement::FirstTouch , "first touch" } ,
+          { MemoryPlacement::Interleave , "interleave " } };
+
+    for(const auto& p : placements)
+    {
+       memoryPlacement() = p.first ;
+       const auto A = laplacian(n);
+       const std::vector<double> x(A.size2(), 1.);
+
+       // output placed with the rows of each thread , reused by every product
+       const auto view = A.rowRange(0, A.size1());
+       auto y = placedVector<double>(rowSplit(A.ia().data(), A.size1(), numThreads()));
+       spmv(view, x.data(), y.data());
+       const auto start = std::chrono::steady_clock::now();
+       for(std::size_t r=0 ; r < runs ; r++)
+          spmv(view, x.data(), y.data());
+       const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start ;
+
+       if(ref.empty()) ref.assign(y.begin(), y.end());
+       const double gb = runs * (A.aa().size()*(sizeof(double)+sizeof(std::size_t)) +
+                                 A.ia().size()*sizeof(std::size_t) + 2*x.size()*sizeof(double)) / 1e9 ;
+       std::cout << p.second << " : " << elapsed.count()/runs*1e3 << " ms / SpMV   "
+                 << gb/elapsed.count() << " GB/s   "
+                 << (std::equal(y.begin(), y.end(), ref.begin(), ref.end()) ? "same result" : "RESULT DIFFERS") << std::endl;
+    }
+  return 0;
+}
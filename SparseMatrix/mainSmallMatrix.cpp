@@ -0,0 +1,100 @@
+# include <chrono>
+# include "DenseMatrix.H"
+# include "BlockedStorage/BCRS/BCRSmatrix.H"
+# include "BlockedStorage/SqBCS/SqBCSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+// evaluated at compile time
+constexpr SmallMatrix<int,2,2> a2 = {{1,2},{3,4}} ;
+static_assert(det(a2) == -2 , "det 2x2");
+static_assert((a2*a2)(2,1) == 15 , "product 2x2");
+static_assert(det(SmallMatrix<double,4,4>::identity()) == 1. , "det 4x4");
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+
+int main(){
+
+  SmallMatrix<double,3,3> a3 = {{4,1,0},{1,5,2},{0,2,6}} ;
+  cout << "det : " << det(a3) << endl << inverse(a3) << a3*inverse(a3) ;
+  cout << "---------------------------------------------------------------------------------------" << endl;
+
+  SmallMatrix<double,5,5> a5 = {{2,1,0,0,3},{1,4,1,0,0},{0,1,4,1,0},{0,0,1,4,1},{3,0,0,1,5}} ;
+  cout << "det : " << det(a5) << endl << a5*inverse(a5) ;
+  for(auto y : a5*std::array<double,5>{1,1,1,1,1}) cout << y << ' ' ;
+  cout << endl;
+
+  try {
+     inverse(SmallMatrix<double,2,2>{{1,2},{2,4}});
+  }
+  catch(MatrixException& e) {
+     cout << e.what() << endl;
+  }
+  cout << "---------------------------------------------------------------------------------------" << endl;
+
+  // blocks read and written in place
+  BCRSmatrix<double,2,3> b = {{11,12,13,14,0,0},{0,22,23,0,0,0},{0,0,33,34,35,36},{0,0,0,44,45,0}} ;
+  cout << "BCRS blocks : " << b.blocks() << endl ;
+  for(std::size_t k=0 ; k < b.blocks() ; k++)
+     cout << b.block(k) << endl ;
+
+  auto blk = b.block(2,2) ;
+  blk *= 10. ;
+  blk(1,1) = -1. ;
+  b.print();
+  cout << "---------------------------------------------------------------------------------------" << endl;
+
+  SqBCSmatrix<double,2> s = {{4,1,0,0},{1,4,0,0},{0,0,2,1},{0,0,1,2}} ;
+  const auto& cs = s ;
+  for(std::size_t k=0 ; k < s.blocks() ; k++)
+     cout << "det " << det(cs.block(k)) << endl << inverse(cs.block(k)) ;
+  s.block(2,2) = transpose(SmallMatrix<double,2,2>{{2,0},{5,2}}) ;
+  s.print();
+  for(auto [bi, bj] : {std::pair<std::size_t,std::size_t>{1,2}, {0,1}})   // zero block , out of range
+  {
+     try {
+        s.block(bi, bj);
+     }
+     catch(MatrixException& e) {
+        cout << e.what() << endl;
+     }
+  }
+  try {
+     cs.block(s.blocks());                     // past the stored blocks
+  }
+  catch(MatrixException& e) {
+     cout << e.what() << endl;
+  }
+  try {
+     b.block(b.blocks());
+  }
+  catch(MatrixException& e) {
+     cout << e.what() << endl;
+  }
+  cout << "---------------------------------------------------------------------------------------" << endl;
+
+  // 3x3 products (rotations) : unrolled fixed size vs DenseMatrix
+  const std::size_t runs = 200000 ;
+  const SmallMatrix<double,3,3> s3 = {{std::cos(0.1),-std::sin(0.1),0},{std::sin(0.1),std::cos(0.1),0},{0,0,1}} ;
+  SmallMatrix<double,3,3> c = SmallMatrix<double,3,3>::identity() ;
+  DenseMatrix<double> d(3) , d3(3) ;
+  for(std::size_t i=1 ; i <= 3 ; i++)
+     for(std::size_t j=1 ; j <= 3 ; j++) { d(i,j) = i == j ; d3(i,j) = s3(i,j) ; }
+
+  const double t0 = ms([&]{ for(std::size_t r=0 ; r < runs ; r++) c = c*s3 ; });
+  const double t1 = ms([&]{ for(std::size_t r=0 ; r < runs ; r++) d = d*d3 ; });
+  cout << "SmallMatrix 3x3 : " << t0 << " ms   DenseMatrix 3x3 : " << t1 << " ms   |c11-d11| "
+       << std::abs(c(1,1)-d(1,1)) << endl;
+
+  return 0;
+}
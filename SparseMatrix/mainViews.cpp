@@ -0,0 +1,90 @@
+# include <chrono>
+# include <random>
+# include "DenseMatrix.H"
+# include "CompressedStorage/CRS/CRSmatrix.H"
+
+using namespace std;
+using namespace mg::numeric::algebra ;
+
+
+template <typename F>
+double ms(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> t = std::chrono::steady_clock::now() - start ;
+    return t.count()*1e3 ;
+}
+
+DenseMatrix<double> randomDense(const std::size_t n, const unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> u(-1., 1.);
+    DenseMatrix<double> a(n, n);
+    for(std::size_t i=1 ; i <= n ; i++)
+       for(std::size_t j=1 ; j <= n ; j++) a(i,j) = u(gen);
+    return a ;
+}
+
+
+int main(int argc, char** argv){
+
+  const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 512 ;
+
+  matrix<double> m = {{1,2,3,4},{5,6,7,8},{9,10,11,12},{13,14,15,16}} ;
+
+  // windows on m : no copy , writes go to m
+  auto top  = m.view(1,1,2,4) ;
+  auto mid  = m.view(2,2,2,2) ;
+  matrix<double> s = mid + m.view(3,3,2,2) * 2.0 ;
+  cout << s ;
+  mid -= s ;
+  top.block(1,3,2,2) = m.view(3,1,2,2) ;
+  cout << m ;
+  for(auto x : m.view(2,1,2,4) * std::vector<double>{1,1,1,1}) cout << x << ' ' ;
+  cout << endl;
+  try {
+     m.view(3,3,2,3);
+  }
+  catch(MatrixException& e) {
+     cout << e.what() << endl;
+  }
+  cout << "------------------------------------------------------------------------------------" <<endl;
+
+  // determinant by cofactors on the view , no minor is built
+  matrix<double> d = {{2,-1,0,3,1},{1,3,2,0,-2},{0,1,4,1,1},{3,0,1,2,0},{1,-2,0,1,5}} ;
+  cout << "det : " << d.det() << "   _det : " << _det(d) << endl;
+  cout << "------------------------------------------------------------------------------------" <<endl;
+
+  // strassen : quadrants are views , 3 temporaries per level instead of 21
+  const auto A = randomDense(n, 1) , B = randomDense(n, 2) ;
+  DenseMatrix<double> C1(n, n) , C2(n, n) ;
+  const double t0 = ms([&]{ C1 = A*B ; });
+  const double t1 = ms([&]{ strassen(A, B, C2, n); });
+  double err = 0 ;
+  for(std::size_t i=1 ; i <= n ; i++)
+     for(std::size_t j=1 ; j <= n ; j++) err = std::max(err, std::abs(C1(i,j) - C2(i,j)));
+  cout << n << "x" << n << "  gemm : " << t0 << " ms   strassen : " << t1 << " ms   |C1-C2| " << err << endl;
+  cout << "------------------------------------------------------------------------------------" <<endl;
+
+  // CRS row panels sharing aa_ / ja_ : stacked SpMV equals the full one
+  CRSmatrix<double> c("mat003.mtx");
+  const std::vector<double> x(c.size2(), 1.) ;
+  const auto y = c*x ;
+  std::vector<double> yp ;
+  const std::size_t panels = 3 ;
+  for(std::size_t p=0 ; p < panels ; p++)
+  {
+     const auto r = threadRange(c.size1(), p, panels);
+     const auto v = c.rowRange(r.first, r.second - r.first) ;
+     cout << "rows " << v.firstRow() << ".." << v.firstRow() + v.size1() << "  nnz " << v.nonZeros()
+          << "  a(1,1) " << v(1,1) << endl;
+     const auto yv = v*x ;
+     yp.insert(yp.end(), yv.begin(), yv.end());
+  }
+  double dy = 0 ;
+  for(std::size_t i=0 ; i < y.size() ; i++) dy = std::max(dy, std::abs(y[i]-yp[i]));
+  cout << "|y - stacked panels| " << dy << endl;
+
+  return 0;
+}